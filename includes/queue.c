@@ -1,85 +1,251 @@
-#include <stdio.h>
-#include <stdlib.h>
-#include <stdbool.h>
-
-#include "utils.h"
-#include "linked_list.h"
-#include "queue.h"
-
-/**
- * queue_new allocates a new queue object
- * 
- * @author Gustavo Reis Bauer
- * 
- * @return a heap allocated queue(needs to freed later)
- * */
-ptr_queue queue_new() {
-    ptr_queue queue = ALLOC(1, queue_t);
-
-    if(!queue) {
-        perror("Couldnt allocate queue object");
-        return NULL;
-    }
-
-    queue->list = linked_list_new();
-
-    return queue;
-}
-
-/**
- * queue_enqueue inserts an element at the end of the queue
- * 
- * @author Gustavo Reis Bauer
- * 
- * @param this is the queue which will have the element inserted
- * @param data is the value of the node which will be added
- * 
- * @return if the node was successfully added
- * */
-bool queue_enqueue(ptr_queue this, int data) {
-    return linked_list_append(this->list, data);
-}
-
-/**
- * queue_dequeue removes the head of the list(dequeues it)
- * 
- * @author Gustavo Reis Bauer
- * 
- * @param this is the queue where the head will be dequeued
- * 
- * @return an lookup result, the data value should be considered only if the staus is OK
- * */
-lookup_result_t queue_dequeue(ptr_queue this) {
-    return linked_list_remove_at(this->list, 0);
-}
-
-/**
- * queue_free deallocates an queue object
- * 
- * @author Gustavo Reis Bauer
- * 
- * @param this is the queue which will be deallocated
- * */
-void queue_free(ptr_queue this) {
-    if(!this) {
-        perror("Cannot free null pointer");
-        return;
-    }
-
-    linked_list_free(this->list);
-
-    free(this);
-}
-
-/**
- * queue_get_len returns the number of elements contained in the queue
- * 
- * @author Gustavo Reis Bauer
- * 
- * @param this is the queue being checked
- * 
- * @return is the length of the list
- * */
-int queue_get_len(ptr_queue this) { 
-    return this->list->len;
-}
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "utils.h"
+#include "linked_list.h"
+#include "queue.h"
+
+#define QUEUE_DEFAULT_CAPACITY 16
+#define QUEUE_MAX_CAPACITY (1 << 30)
+
+/**
+ * queue_index maps the position of an element relative to the front of the queue to its slot in the buffer
+ * 
+ * @author Gustavo Reis Bauer
+ * 
+ * @param this is the queue being looked at
+ * @param offset is the distance of the element from the front of the queue
+ * 
+ * @return the slot of the element in this->items
+ * */
+inline static int queue_index(ptr_queue this, int offset) { return (this->head + offset) & (this->capacity - 1); }
+
+/**
+ * queue_round_capacity rounds a requested capacity up to the next power of two
+ * 
+ * @author Gustavo Reis Bauer
+ * 
+ * @param capacity is the requested capacity
+ * 
+ * @return the smallest power of two which is at least capacity
+ * */
+static int queue_round_capacity(int capacity) {
+    int rounded = 1;
+
+    while(rounded < capacity)
+        rounded <<= 1;
+
+    return rounded;
+}
+
+/**
+ * queue_grow doubles the capacity of the queue, the live elements keep their order
+ * 
+ * @author Gustavo Reis Bauer
+ * 
+ * @param this is the queue which will grow
+ * 
+ * @return if the queue has room for one more element, on failure the queue is left untouched
+ * */
+static bool queue_grow(ptr_queue this) {
+    const int old_capacity = this->capacity;
+
+    if(old_capacity >= QUEUE_MAX_CAPACITY) {
+        perror("Cannot grow the queue past its maximum capacity");
+        return false;
+    }
+
+    int *items = realloc(this->items, (size_t) old_capacity * 2 * sizeof(int));
+
+    if(!items) {
+        perror("Could not reallocate the queue buffer");
+        return false;
+    }
+
+    this->items = items;
+    this->capacity = old_capacity * 2;
+
+    //The elements that wrapped around to the start of the old buffer are the only ones out of place,
+    //so whichever of the two segments is smaller gets moved next to the other one
+    const int head_segment = old_capacity - this->head;
+    const int wrapped_segment = this->len - head_segment;
+
+    if(wrapped_segment <= 0)
+        return true;
+
+    if(wrapped_segment <= head_segment) {
+        memcpy(items + old_capacity, items, (size_t) wrapped_segment * sizeof(int));
+    } else {
+        memcpy(items + this->capacity - head_segment, items + this->head, (size_t) head_segment * sizeof(int));
+        this->head += old_capacity;
+    }
+
+    return true;
+}
+
+/**
+ * queue_new allocates a new queue object
+ * 
+ * @author Gustavo Reis Bauer
+ * 
+ * @return a heap allocated queue(needs to freed later)
+ * */
+ptr_queue queue_new() {
+    return queue_new_with_capacity(QUEUE_DEFAULT_CAPACITY);
+}
+
+/**
+ * queue_new_with_capacity allocates a new queue object with room for at least capacity elements
+ * 
+ * @author Gustavo Reis Bauer
+ * 
+ * @param capacity is the number of elements which can be enqueued before the queue needs to grow, it is rounded up to a power of two
+ * 
+ * @return a heap allocated queue(needs to freed later)\n
+ *         NULL if the object could not be allocated
+ * */
+ptr_queue queue_new_with_capacity(int capacity) {
+    if(capacity < 0 || capacity > QUEUE_MAX_CAPACITY) {
+        perror("Cannot create a queue with the requested capacity");
+        return NULL;
+    }
+
+    ptr_queue queue = ALLOC(1, queue_t);
+
+    if(!queue) {
+        perror("Couldnt allocate queue object");
+        return NULL;
+    }
+
+    queue->capacity = queue_round_capacity(capacity);
+    queue->items = ALLOC(queue->capacity, int);
+
+    if(!queue->items) {
+        perror("Couldnt allocate queue buffer");
+        free(queue);
+        return NULL;
+    }
+
+    queue->head = 0;
+    queue->len = 0;
+
+    return queue;
+}
+
+/**
+ * queue_enqueue inserts an element at the end of the queue
+ * 
+ * @author Gustavo Reis Bauer
+ * 
+ * @param this is the queue which will have the element inserted
+ * @param data is the value of the node which will be added
+ * 
+ * @return if the node was successfully added
+ * */
+bool queue_enqueue(ptr_queue this, int data) {
+    if(!this) {
+        perror("Cannot enqueue an element to a non allocated queue");
+        return false;
+    }
+
+    if(this->len == this->capacity && !queue_grow(this))
+        return false;
+
+    this->items[queue_index(this, this->len)] = data;
+    this->len++;
+
+    return true;
+}
+
+/**
+ * queue_dequeue removes the head of the list(dequeues it)
+ * 
+ * @author Gustavo Reis Bauer
+ * 
+ * @param this is the queue where the head will be dequeued
+ * 
+ * @return an lookup result, the data value should be considered only if the staus is OK
+ * */
+lookup_result_t queue_dequeue(ptr_queue this) {
+    lookup_result_t result;
+
+    if(!this) {
+        perror("Cannot dequeue from a non allocated queue");
+        result.status = INVALID_LIST;
+
+        return result;
+    }
+
+    if(!this->len) {
+        perror("Cannot dequeue from an empty queue");
+        result.status = EMPTY_LIST;
+
+        return result;
+    }
+
+    result.status = OK;
+    result.value = this->items[this->head];
+
+    this->head = queue_index(this, 1);
+    this->len--;
+
+    return result;
+}
+
+/**
+ * queue_print prints the elements of the queue to the standard output, from the front to the back
+ * 
+ * @author Gustavo Reis Bauer
+ * 
+ * @param this is the queue which will be printed
+ * */
+void queue_print(ptr_queue this) {
+    if(!this) {
+        perror("Cannot iterate over a non allocated queue");
+        return;
+    }
+
+    if(!this->len) {
+        printf("[ ]\n");
+        return;
+    }
+
+    printf("[ ");
+
+    for(int i = 0; i < this->len - 1; i++)
+        printf("%d, ", this->items[queue_index(this, i)]);
+
+    printf("%d ]\n", this->items[queue_index(this, this->len - 1)]);
+}
+
+/**
+ * queue_free deallocates an queue object
+ * 
+ * @author Gustavo Reis Bauer
+ * 
+ * @param this is the queue which will be deallocated
+ * */
+void queue_free(ptr_queue this) {
+    if(!this) {
+        perror("Cannot free null pointer");
+        return;
+    }
+
+    free(this->items);
+    free(this);
+}
+
+/**
+ * queue_get_len returns the number of elements contained in the queue
+ * 
+ * @author Gustavo Reis Bauer
+ * 
+ * @param this is the queue being checked
+ * 
+ * @return is the length of the list
+ * */
+int queue_get_len(ptr_queue this) { 
+    return this->len;
+}
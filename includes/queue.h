@@ -1,21 +1,32 @@
-#pragma once
-    #include "linked_list.h"
-
-    //Queue is just a list where you can only insert at the end and remove at the front
-    typedef struct queue {
-        //This queue implementations uses an linked list as its main data structure
-        ptr_linked_list list;
-
-    } queue_t;
-
-    //Pointer to a queue
-    typedef queue_t * ptr_queue;
-    
-    ptr_queue queue_new();
-
-    bool queue_enqueue(ptr_queue this, int data);
-    lookup_result_t queue_dequeue(ptr_queue this);
-
-    int queue_get_len(ptr_queue this);
-
-    void queue_free(ptr_queue this);
+#pragma once
+    #include "linked_list.h"
+
+    //Queue is just a list where you can only insert at the end and remove at the front
+    typedef struct queue {
+        //items is a circular buffer, its capacity is always a power of two so indexes wrap with a mask
+        int *items;
+
+        //head is the position in items of the front of the queue
+        int head;
+
+        //len is the number of elements currently in the queue
+        int len;
+
+        //capacity is the size of items, always a power of two
+        int capacity;
+
+    } queue_t;
+
+    //Pointer to a queue
+    typedef queue_t * ptr_queue;
+    
+    ptr_queue queue_new();
+    ptr_queue queue_new_with_capacity(int capacity);
+
+    bool queue_enqueue(ptr_queue this, int data);
+    lookup_result_t queue_dequeue(ptr_queue this);
+
+    int queue_get_len(ptr_queue this);
+
+    void queue_print(ptr_queue this);
+    void queue_free(ptr_queue this);
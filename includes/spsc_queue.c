@@ -0,0 +1,277 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+#include "utils.h"
+#include "linked_list.h"
+#include "spsc_queue.h"
+
+#define SPSC_QUEUE_MAX_CAPACITY (1 << 30)
+
+/**
+ * spsc_queue_new allocates a bounded single producer/single consumer queue
+ * 
+ * @author Gustavo Reis Bauer
+ * 
+ * @param capacity is the maximum number of elements the queue holds, it is rounded up to a power of two
+ * 
+ * @return a heap allocated queue(needs to be freed later)\n
+ *         NULL if the object could not be allocated
+ * */
+ptr_spsc_queue spsc_queue_new(int capacity) {
+    if(capacity <= 0 || capacity > SPSC_QUEUE_MAX_CAPACITY) {
+        perror("Cannot create a spsc queue with the requested capacity");
+        return NULL;
+    }
+
+    size_t rounded = 1;
+
+    while(rounded < (size_t) capacity)
+        rounded <<= 1;
+
+    ptr_spsc_queue queue = aligned_alloc(CACHE_LINE_SIZE, sizeof(spsc_queue_t));
+
+    if(!queue) {
+        perror("Could not allocate spsc queue object");
+        return NULL;
+    }
+
+    queue->items = ALLOC(rounded, int);
+
+    if(!queue->items) {
+        perror("Could not allocate spsc queue buffer");
+        free(queue);
+        return NULL;
+    }
+
+    atomic_init(&queue->head, 0);
+    atomic_init(&queue->tail, 0);
+
+    queue->cached_head = 0;
+    queue->cached_tail = 0;
+    queue->mask = rounded - 1;
+
+    return queue;
+}
+
+/**
+ * spsc_queue_free_slots returns how many elements the producer can write, refreshing its view of head only when needed
+ * 
+ * @author Gustavo Reis Bauer
+ * 
+ * @param this is the queue, must only be called from the producer thread
+ * @param tail is the current value of tail
+ * @param wanted is how many slots the producer would like to have
+ * 
+ * @return the number of free slots known to the producer
+ * */
+static size_t spsc_queue_free_slots(ptr_spsc_queue this, size_t tail, size_t wanted) {
+    size_t free_slots = this->mask + 1 - (tail - this->cached_head);
+
+    if(free_slots >= wanted)
+        return free_slots;
+
+    this->cached_head = atomic_load_explicit(&this->head, memory_order_acquire);
+
+    return this->mask + 1 - (tail - this->cached_head);
+}
+
+/**
+ * spsc_queue_used_slots returns how many elements the consumer can read, refreshing its view of tail only when needed
+ * 
+ * @author Gustavo Reis Bauer
+ * 
+ * @param this is the queue, must only be called from the consumer thread
+ * @param head is the current value of head
+ * @param wanted is how many elements the consumer would like to read
+ * 
+ * @return the number of readable elements known to the consumer
+ * */
+static size_t spsc_queue_used_slots(ptr_spsc_queue this, size_t head, size_t wanted) {
+    size_t used_slots = this->cached_tail - head;
+
+    if(used_slots >= wanted)
+        return used_slots;
+
+    this->cached_tail = atomic_load_explicit(&this->tail, memory_order_acquire);
+
+    return this->cached_tail - head;
+}
+
+/**
+ * spsc_queue_try_enqueue inserts an element at the end of the queue if there is room for it
+ * 
+ * @author Gustavo Reis Bauer
+ * 
+ * @param this is the queue, must only be called from the producer thread
+ * @param data is the value which will be inserted
+ * 
+ * @return if the element was inserted, false means the queue is full
+ * */
+bool spsc_queue_try_enqueue(ptr_spsc_queue this, int data) {
+    const size_t tail = atomic_load_explicit(&this->tail, memory_order_relaxed);
+
+    if(!spsc_queue_free_slots(this, tail, 1))
+        return false;
+
+    this->items[tail & this->mask] = data;
+
+    atomic_store_explicit(&this->tail, tail + 1, memory_order_release);
+
+    return true;
+}
+
+/**
+ * spsc_queue_try_enqueue_batch inserts as many elements of data as fit, publishing them all at once
+ * 
+ * @author Gustavo Reis Bauer
+ * 
+ * @param this is the queue, must only be called from the producer thread
+ * @param data is the array of values which will be inserted, in order
+ * @param count is the number of elements in data
+ * 
+ * @return the number of elements inserted, the first ones of data
+ * */
+int spsc_queue_try_enqueue_batch(ptr_spsc_queue this, const int *data, int count) {
+    if(count <= 0)
+        return 0;
+
+    const size_t tail = atomic_load_explicit(&this->tail, memory_order_relaxed);
+    size_t n = spsc_queue_free_slots(this, tail, (size_t) count);
+
+    if(n > (size_t) count)
+        n = (size_t) count;
+
+    for(size_t i = 0; i < n; i++)
+        this->items[(tail + i) & this->mask] = data[i];
+
+    atomic_store_explicit(&this->tail, tail + n, memory_order_release);
+
+    return (int) n;
+}
+
+/**
+ * spsc_queue_try_dequeue removes the front element of the queue if there is one
+ * 
+ * @author Gustavo Reis Bauer
+ * 
+ * @param this is the queue, must only be called from the consumer thread
+ * 
+ * @return an lookup result, EMPTY_LIST if there was nothing to dequeue, the value should be considered only if the status is OK
+ * */
+lookup_result_t spsc_queue_try_dequeue(ptr_spsc_queue this) {
+    lookup_result_t result;
+
+    if(!this) {
+        result.status = INVALID_LIST;
+        return result;
+    }
+
+    const size_t head = atomic_load_explicit(&this->head, memory_order_relaxed);
+
+    if(!spsc_queue_used_slots(this, head, 1)) {
+        result.status = EMPTY_LIST;
+        return result;
+    }
+
+    result.status = OK;
+    result.value = this->items[head & this->mask];
+
+    atomic_store_explicit(&this->head, head + 1, memory_order_release);
+
+    return result;
+}
+
+/**
+ * spsc_queue_try_dequeue_batch removes up to count elements from the front of the queue, releasing their slots all at once
+ * 
+ * @author Gustavo Reis Bauer
+ * 
+ * @param this is the queue, must only be called from the consumer thread
+ * @param out is the buffer which receives the elements, it must hold at least count elements
+ * @param count is the maximum number of elements to dequeue
+ * 
+ * @return an lookup result whose value is the number of elements written to out when the status is OK,
+ *         EMPTY_LIST if there was nothing to dequeue
+ * */
+lookup_result_t spsc_queue_try_dequeue_batch(ptr_spsc_queue this, int *out, int count) {
+    lookup_result_t result;
+
+    if(!this) {
+        result.status = INVALID_LIST;
+        return result;
+    }
+
+    if(count <= 0 || !out) {
+        result.status = INDEX_OUT_OF_BOUNDS;
+        return result;
+    }
+
+    const size_t head = atomic_load_explicit(&this->head, memory_order_relaxed);
+    size_t n = spsc_queue_used_slots(this, head, (size_t) count);
+
+    if(!n) {
+        result.status = EMPTY_LIST;
+        return result;
+    }
+
+    if(n > (size_t) count)
+        n = (size_t) count;
+
+    for(size_t i = 0; i < n; i++)
+        out[i] = this->items[(head + i) & this->mask];
+
+    atomic_store_explicit(&this->head, head + n, memory_order_release);
+
+    result.status = OK;
+    result.value = (int) n;
+
+    return result;
+}
+
+/**
+ * spsc_queue_get_len returns the number of elements in the queue, it is only a snapshot when both threads are running
+ * 
+ * @author Gustavo Reis Bauer
+ * 
+ * @param this is the queue being checked
+ * 
+ * @return the number of elements in the queue
+ * */
+int spsc_queue_get_len(ptr_spsc_queue this) {
+    const size_t head = atomic_load_explicit(&this->head, memory_order_acquire);
+    const size_t tail = atomic_load_explicit(&this->tail, memory_order_acquire);
+
+    return tail >= head ? (int) (tail - head) : 0;
+}
+
+/**
+ * spsc_queue_get_capacity returns the maximum number of elements the queue can hold
+ * 
+ * @author Gustavo Reis Bauer
+ * 
+ * @param this is the queue being checked
+ * 
+ * @return the queue capacity
+ * */
+int spsc_queue_get_capacity(ptr_spsc_queue this) {
+    return (int) (this->mask + 1);
+}
+
+/**
+ * spsc_queue_free deallocates a spsc queue, no thread may be using it anymore
+ * 
+ * @author Gustavo Reis Bauer
+ * 
+ * @param this is the queue which will be deallocated
+ * */
+void spsc_queue_free(ptr_spsc_queue this) {
+    if(!this) {
+        perror("Cannot free null pointer");
+        return;
+    }
+
+    free(this->items);
+    free(this);
+}
@@ -0,0 +1,44 @@
+#pragma once
+    #include <stddef.h>
+    #include <stdatomic.h>
+
+    #include "utils.h"
+    #include "linked_list.h"
+
+    //Bounded lock-free queue for exactly one producer thread and one consumer thread
+    typedef struct spsc_queue {
+        //tail is the next position to be written, only the producer stores to it
+        _Alignas(CACHE_LINE_SIZE) atomic_size_t tail;
+
+        //cached_head is the producer's last seen value of head, so it only reads the consumer line when the queue looks full
+        size_t cached_head;
+
+        //head is the next position to be read, only the consumer stores to it
+        _Alignas(CACHE_LINE_SIZE) atomic_size_t head;
+
+        //cached_tail is the consumer's last seen value of tail, so it only reads the producer line when the queue looks empty
+        size_t cached_tail;
+
+        //items is the ring buffer, head and tail grow forever and are masked into it
+        _Alignas(CACHE_LINE_SIZE) int *items;
+
+        //mask is the capacity minus one, the capacity is always a power of two
+        size_t mask;
+
+    } spsc_queue_t;
+
+    //Pointer to a spsc queue
+    typedef spsc_queue_t * ptr_spsc_queue;
+
+    ptr_spsc_queue spsc_queue_new(int capacity);
+
+    bool spsc_queue_try_enqueue(ptr_spsc_queue this, int data);
+    int spsc_queue_try_enqueue_batch(ptr_spsc_queue this, const int *data, int count);
+
+    lookup_result_t spsc_queue_try_dequeue(ptr_spsc_queue this);
+    lookup_result_t spsc_queue_try_dequeue_batch(ptr_spsc_queue this, int *out, int count);
+
+    int spsc_queue_get_len(ptr_spsc_queue this);
+    int spsc_queue_get_capacity(ptr_spsc_queue this);
+
+    void spsc_queue_free(ptr_spsc_queue this);
@@ -1,111 +1,306 @@
-#include <stdio.h>
-#include <stdlib.h>
-#include <stdbool.h>
-
-#include "utils.h"
-#include "linked_list.h"
-#include "stack.h"
-
-/**
- * stack_new instantiates an heap allocated stack
- * 
- * @author Gustavo Reis Bauer
- * 
- * @return an heap allocated stack(needs to be freed later)
- * */
-ptr_stack stack_new() {
-    ptr_stack stack = ALLOC(1, stack_t);
-
-    if(!stack) {
-        perror("Could not allocate stack object");
-        return NULL;
-    }
-
-    stack->list = linked_list_new();
-
-    return stack;
-}
-
-/**
- * stack_push inserts an element to the end of the stack
- * 
- * @author Gustavo Reis Bauer
- * 
- * @param this is the instance of the stack which will have a new element added to
- * @param data is the value of the new element
- * 
- * @return if the element was properly added
- * */
-bool stack_push(ptr_stack this, int data) {
-    return linked_list_append(this->list, data);
-}
-
-/**
- * stack_pop removes the last element of the stack
- * 
- * @author Gustavo Reis Bauer
- * 
- * @param this is the instance of the stack
- * 
- * @return an lookup result, if status is not OK then its data should not be considered
- * */
-lookup_result_t stack_pop(ptr_stack this) {
-    return linked_list_remove_last(this->list);
-}
-
-/**
- * stack_is_empty checks if a stack is empty
- * 
- * @author Gustavo Reis Bauer
- * 
- * @param this is the istance of the stack
- * 
- * @return if the stack is empty
- * */
-bool stack_is_empty(ptr_stack this) {
-    return linked_list_is_empty(this->list);
-}
-
-/**
- * stack_peek returns the top element of the stack
- * 
- * @author Gustavo Reis Bauer
- * 
- * @param this is the instance of the stack
- * 
- * @return the result of the peek, if the result status is not OK then its data should not be considered
- * */
-lookup_result_t stack_peek(ptr_stack this) {
-    return linked_list_get(this->list, this->list->len - 1);
-}
-
-/**
- * stack_get_len returns the size of the stack
- * 
- * @author Gustavo Reis Bauer
- * 
- * @param this is the instance of the stack
- * 
- * @return the stack size
- * */
-int stack_get_len(ptr_stack this) {
-    return this->list->len;
-}
-
-/**
- * stack_free deallocates an stack from the memory(it cannot be used after)
- * 
- * @author Gustavo Reis Bauer
- * 
- * @param this is the instance of the stack
- * */
-void stack_free(ptr_stack this) {
-    if(!this) {
-        perror("Cannot free a non allocated stack");
-        return;
-    }
-
-    linked_list_free(this->list);
-
-    free(this);
-}
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <limits.h>
+
+#include "utils.h"
+#include "linked_list.h"
+#include "stack.h"
+
+#define STACK_DEFAULT_CAPACITY 8
+
+/**
+ * stack_resize reallocates the stack buffer so it can hold exactly capacity elements
+ * 
+ * @author Gustavo Reis Bauer
+ * 
+ * @param this is the instance of the stack
+ * @param capacity is the new capacity, it must not be smaller than the stack length
+ * 
+ * @return if the buffer was properly reallocated, on failure the stack is left untouched
+ * */
+static bool stack_resize(ptr_stack this, int capacity) {
+    int *items = realloc(this->items, (size_t) capacity * sizeof(int));
+
+    if(!items) {
+        perror("Could not reallocate the stack buffer");
+        return false;
+    }
+
+    this->items = items;
+    this->capacity = capacity;
+
+    return true;
+}
+
+/**
+ * stack_grow doubles the stack capacity so at least one more element fits
+ * 
+ * @author Gustavo Reis Bauer
+ * 
+ * @param this is the instance of the stack
+ * 
+ * @return if the stack has room for one more element
+ * */
+static bool stack_grow(ptr_stack this) {
+    if(this->capacity > INT_MAX / 2) {
+        perror("Cannot grow the stack past its maximum capacity");
+        return false;
+    }
+
+    return stack_resize(this, this->capacity ? this->capacity * 2 : STACK_DEFAULT_CAPACITY);
+}
+
+/**
+ * stack_new instantiates an heap allocated stack
+ * 
+ * @author Gustavo Reis Bauer
+ * 
+ * @return an heap allocated stack(needs to be freed later)
+ * */
+ptr_stack stack_new() {
+    return stack_new_with_capacity(STACK_DEFAULT_CAPACITY);
+}
+
+/**
+ * stack_new_with_capacity instantiates an heap allocated stack with room for capacity elements
+ * 
+ * @author Gustavo Reis Bauer
+ * 
+ * @param capacity is the number of elements which can be pushed before the stack needs to grow
+ * 
+ * @return an heap allocated stack(needs to be freed later)\n
+ *         NULL if the object could not be allocated
+ * */
+ptr_stack stack_new_with_capacity(int capacity) {
+    if(capacity < 0) {
+        perror("Cannot create a stack with a negative capacity");
+        return NULL;
+    }
+
+    ptr_stack stack = ALLOC(1, stack_t);
+
+    if(!stack) {
+        perror("Could not allocate stack object");
+        return NULL;
+    }
+
+    stack->items = NULL;
+    stack->len = 0;
+    stack->capacity = 0;
+
+    if(capacity && !stack_resize(stack, capacity)) {
+        free(stack);
+        return NULL;
+    }
+
+    return stack;
+}
+
+/**
+ * stack_push inserts an element to the end of the stack
+ * 
+ * @author Gustavo Reis Bauer
+ * 
+ * @param this is the instance of the stack which will have a new element added to
+ * @param data is the value of the new element
+ * 
+ * @return if the element was properly added
+ * */
+bool stack_push(ptr_stack this, int data) {
+    if(!this) {
+        perror("Cannot push an element to a non allocated stack");
+        return false;
+    }
+
+    if(this->len == this->capacity && !stack_grow(this))
+        return false;
+
+    this->items[this->len++] = data;
+
+    return true;
+}
+
+/**
+ * stack_pop removes the last element of the stack
+ * 
+ * @author Gustavo Reis Bauer
+ * 
+ * @param this is the instance of the stack
+ * 
+ * @return an lookup result, if status is not OK then its data should not be considered
+ * */
+lookup_result_t stack_pop(ptr_stack this) {
+    lookup_result_t result = stack_peek(this);
+
+    if(is_ok(&result))
+        this->len--;
+
+    return result;
+}
+
+/**
+ * stack_is_empty checks if a stack is empty
+ * 
+ * @author Gustavo Reis Bauer
+ * 
+ * @param this is the istance of the stack
+ * 
+ * @return if the stack is empty
+ * */
+bool stack_is_empty(ptr_stack this) {
+    return !this->len;
+}
+
+/**
+ * stack_peek returns the top element of the stack
+ * 
+ * @author Gustavo Reis Bauer
+ * 
+ * @param this is the instance of the stack
+ * 
+ * @return the result of the peek, if the result status is not OK then its data should not be considered
+ * */
+lookup_result_t stack_peek(ptr_stack this) {
+    lookup_result_t result;
+
+    if(!this) {
+        perror("Cannot look at a non allocated stack");
+        result.status = INVALID_LIST;
+
+        return result;
+    }
+
+    if(stack_is_empty(this)) {
+        perror("Cannot look at the top of an empty stack");
+        result.status = EMPTY_LIST;
+
+        return result;
+    }
+
+    result.status = OK;
+    result.value = this->items[this->len - 1];
+
+    return result;
+}
+
+/**
+ * stack_reserve makes sure the stack can hold at least capacity elements without growing
+ * 
+ * @author Gustavo Reis Bauer
+ * 
+ * @param this is the instance of the stack
+ * @param capacity is the minimum number of elements the stack must be able to hold
+ * 
+ * @return if the stack can hold capacity elements
+ * */
+bool stack_reserve(ptr_stack this, int capacity) {
+    if(!this) {
+        perror("Cannot reserve memory for a non allocated stack");
+        return false;
+    }
+
+    if(capacity <= this->capacity)
+        return true;
+
+    return stack_resize(this, capacity);
+}
+
+/**
+ * stack_shrink_to_fit releases the unused part of the stack buffer
+ * 
+ * @author Gustavo Reis Bauer
+ * 
+ * @param this is the instance of the stack
+ * 
+ * @return if the buffer was shrunk, on failure the stack keeps its old buffer
+ * */
+bool stack_shrink_to_fit(ptr_stack this) {
+    if(!this) {
+        perror("Cannot shrink a non allocated stack");
+        return false;
+    }
+
+    if(this->len == this->capacity)
+        return true;
+
+    if(!this->len) {
+        free(this->items);
+
+        this->items = NULL;
+        this->capacity = 0;
+
+        return true;
+    }
+
+    return stack_resize(this, this->len);
+}
+
+/**
+ * stack_get_len returns the size of the stack
+ * 
+ * @author Gustavo Reis Bauer
+ * 
+ * @param this is the instance of the stack
+ * 
+ * @return the stack size
+ * */
+int stack_get_len(ptr_stack this) {
+    return this->len;
+}
+
+/**
+ * stack_get_capacity returns how many elements the stack can hold before it needs to grow
+ * 
+ * @author Gustavo Reis Bauer
+ * 
+ * @param this is the instance of the stack
+ * 
+ * @return the stack capacity
+ * */
+int stack_get_capacity(ptr_stack this) {
+    return this->capacity;
+}
+
+/**
+ * stack_print prints the elements of the stack to the standard output, from the bottom to the top
+ * 
+ * @author Gustavo Reis Bauer
+ * 
+ * @param this is the instance of the stack
+ * */
+void stack_print(ptr_stack this) {
+    if(!this) {
+        perror("Cannot iterate over a non allocated stack");
+        return;
+    }
+
+    if(stack_is_empty(this)) {
+        printf("[ ]\n");
+        return;
+    }
+
+    printf("[ ");
+
+    for(int i = 0; i < this->len - 1; i++)
+        printf("%d, ", this->items[i]);
+
+    printf("%d ]\n", this->items[this->len - 1]);
+}
+
+/**
+ * stack_free deallocates an stack from the memory(it cannot be used after)
+ * 
+ * @author Gustavo Reis Bauer
+ * 
+ * @param this is the instance of the stack
+ * */
+void stack_free(ptr_stack this) {
+    if(!this) {
+        perror("Cannot free a non allocated stack");
+        return;
+    }
+
+    free(this->items);
+    free(this);
+}
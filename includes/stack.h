@@ -1,21 +1,33 @@
-#pragma once
-    #include "linked_list.h"
-    
-    //Stack representation, made on top of a linked list
-    typedef struct stack_t {
-        ptr_linked_list list;
-    } stack_t;
-
-    typedef stack_t * ptr_stack;
-
-    ptr_stack stack_new();
-
-    bool stack_push(ptr_stack this, int data);
-    bool stack_is_empty(ptr_stack this);
-
-    lookup_result_t stack_pop(ptr_stack this);
-    lookup_result_t stack_peek(ptr_stack this);
-
-    int stack_get_len(ptr_stack this);
-
-    void stack_free(ptr_stack this);
\ No newline at end of file
+#pragma once
+    #include "linked_list.h"
+    
+    //Stack representation, made on top of a contiguous growable array so push, pop and peek are amortized O(1)
+    typedef struct stack_t {
+        //items is the buffer holding the elements, the top of the stack is items[len - 1]
+        int *items;
+
+        //len is the number of elements currently on the stack
+        int len;
+
+        //capacity is the number of elements items can hold before it needs to grow
+        int capacity;
+    } stack_t;
+
+    typedef stack_t * ptr_stack;
+
+    ptr_stack stack_new();
+    ptr_stack stack_new_with_capacity(int capacity);
+
+    bool stack_push(ptr_stack this, int data);
+    bool stack_is_empty(ptr_stack this);
+    bool stack_reserve(ptr_stack this, int capacity);
+    bool stack_shrink_to_fit(ptr_stack this);
+
+    lookup_result_t stack_pop(ptr_stack this);
+    lookup_result_t stack_peek(ptr_stack this);
+
+    int stack_get_len(ptr_stack this);
+    int stack_get_capacity(ptr_stack this);
+
+    void stack_print(ptr_stack this);
+    void stack_free(ptr_stack this);
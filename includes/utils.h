@@ -1,4 +1,7 @@
-#pragma once
-    //Wrapper for calloc
-    #define ALLOC(number_of_elements, obj_type) (obj_type *) calloc(number_of_elements, sizeof(obj_type))
-    
\ No newline at end of file
+#pragma once
+    //Wrapper for calloc
+    #define ALLOC(number_of_elements, obj_type) (obj_type *) calloc(number_of_elements, sizeof(obj_type))
+
+    //Size of a cache line, used to keep data written by different threads on separate lines
+    #define CACHE_LINE_SIZE 64
+    
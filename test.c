@@ -42,7 +42,7 @@ int main(int argc, char **argv) {
         }
     }
 
-    linked_list_print(queue->list);
+    queue_print(queue);
     queue_free(queue);
 
     puts("Teste stacks:");
@@ -64,7 +64,7 @@ int main(int argc, char **argv) {
         printf("%d valor: %d\n", i, result.value);
     }
 
-    linked_list_print(stack->list);
+    stack_print(stack);
     
     stack_free(stack);
     return EXIT_SUCCESS;